@@ -0,0 +1,11 @@
+@echo off
+rem Tiny+ benchmark: compiles the suite, reporting the compile
+rem time, then runs every job in jobs.txt the given number of
+rem rounds (5 by default), reporting instructions retired and
+rem VM MIPS.   usage: bench [rounds]
+setlocal
+cd /d %~dp0
+set ROUNDS=%1
+if "%ROUNDS%"=="" set ROUNDS=5
+..\bin\Tiny.exe @programs.txt || exit /b 1
+..\bin\TM.exe -b -r%ROUNDS% jobs.txt
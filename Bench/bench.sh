@@ -0,0 +1,20 @@
+#!/bin/sh
+# Tiny+ benchmark: compiles the suite, reporting the compile
+# time, then runs every job in jobs.txt the given number of
+# rounds (5 by default), reporting instructions retired and
+# VM MIPS.   usage: bench.sh [rounds]
+# TINY and TM name the compiler and simulator to use; they
+# default to the Tiny.exe and TM.exe the solution builds into
+# bin, so elsewhere set them, e.g.
+#     TINY=/path/to/tiny TM=/path/to/tm ./bench.sh
+cd "$(dirname "$0")" || exit 1
+TINY=${TINY:-../bin/Tiny.exe}
+TM=${TM:-../bin/TM.exe}
+for f in "$TINY" "$TM"; do
+  if [ ! -x "$f" ]; then
+    echo "bench.sh: $f is not an executable; build the solution or set TINY and TM" >&2
+    exit 1
+  fi
+done
+"$TINY" @programs.txt || exit 1
+exec "$TM" -b -r"${1:-5}" jobs.txt